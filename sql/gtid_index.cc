@@ -744,7 +744,7 @@ int Gtid_index_writer::give_error(const char *msg)
 
 
 Gtid_index_reader::Gtid_index_reader()
-  : n(nullptr), index_file(-1),
+  : n(nullptr), index_file(-1), file_end(0),
     file_open(false), index_valid(false), has_root_node(false),
     version_major(0), version_minor(0)
 {
@@ -1072,10 +1072,7 @@ Gtid_index_reader::read_file_header()
 
   uchar buf[GTID_INDEX_FILE_HEADER_SIZE + GTID_INDEX_PAGE_HEADER_SIZE];
 
-  if (MY_FILEPOS_ERROR == mysql_file_seek(index_file, 0, MY_SEEK_SET, MYF(0)) ||
-      mysql_file_read(index_file, buf,
-                      GTID_INDEX_FILE_HEADER_SIZE + GTID_INDEX_PAGE_HEADER_SIZE,
-                      MYF(MY_NABP)))
+  if (mysql_file_pread(index_file, buf, sizeof(buf), 0, MYF(MY_NABP)))
     return give_error("Error reading page from index file");
   if (memcmp(&buf[0], GTID_INDEX_MAGIC, sizeof(GTID_INDEX_MAGIC)))
     return give_error("Corrupt index file, magic not found in header");
@@ -1093,7 +1090,8 @@ Gtid_index_reader::read_file_header()
   if (!buf3)
     return give_error("Error allocating memory for index page");
   int res= 0;
-  if (mysql_file_read(index_file, buf3, page_size - sizeof(buf), MYF(MY_NABP)))
+  if (mysql_file_pread(index_file, buf3, page_size - sizeof(buf), sizeof(buf),
+                       MYF(MY_NABP)))
     res= give_error("Error reading page from index file");
   else
   {
@@ -1105,6 +1103,14 @@ Gtid_index_reader::read_file_header()
   if (res)
     return res;
 
+  /*
+    Remember the file size, so that the pages of the root node can be read
+    from the end of the file with positioned reads and no further seeks.
+  */
+  file_end= mysql_file_seek(index_file, 0, MY_SEEK_END, MYF(0));
+  if (file_end == MY_FILEPOS_ERROR || file_end < page_size)
+    return give_error("Error seeking index file");
+
   /*
     Check that there is a valid root node at the end of the file.
     If there is not, the index may be a "hot index" that is currently being
@@ -1121,10 +1127,8 @@ Gtid_index_reader::read_file_header()
   else
   {
     uchar buf2[GTID_INDEX_PAGE_HEADER_SIZE];
-    if (MY_FILEPOS_ERROR == mysql_file_seek(index_file, -(int32)page_size,
-                                            MY_SEEK_END, MYF(0)) ||
-        mysql_file_read(index_file, buf2, GTID_INDEX_PAGE_HEADER_SIZE,
-                        MYF(MY_NABP)))
+    if (mysql_file_pread(index_file, buf2, GTID_INDEX_PAGE_HEADER_SIZE,
+                         file_end - page_size, MYF(MY_NABP)))
       return give_error("Error reading root page from index file");
     flags= buf2[0];
     has_root_node= ((flags & needed_flags) == needed_flags);
@@ -1146,8 +1150,12 @@ Gtid_index_reader::verify_checksum(Gtid_index_base::Node_page *page)
 }
 
 
+/*
+  Allocate a page and read it from file offset 'pos'. Positioned reads are
+  used so that each page costs a single system call.
+*/
 Gtid_index_base::Node_page *
-Gtid_index_reader::alloc_and_read_page()
+Gtid_index_reader::alloc_and_read_page(my_off_t pos)
 {
   Node_page *page= alloc_page();
   if (!page)
@@ -1155,7 +1163,7 @@ Gtid_index_reader::alloc_and_read_page()
     give_error("Error allocating memory for index page");
     return nullptr;
   }
-  if (mysql_file_read(index_file, page->page, page_size, MYF(MY_NABP)))
+  if (mysql_file_pread(index_file, page->page, page_size, pos, MYF(MY_NABP)))
   {
     my_free(page);
     give_error("Error reading page from index file");
@@ -1182,16 +1190,16 @@ Gtid_index_reader::read_root_node()
     Read pages one by one from the back of the file until we have a complete
     root node.
   */
-  if (MY_FILEPOS_ERROR == mysql_file_seek(index_file, -(int32)page_size,
-                                          MY_SEEK_END, MYF(0)))
+  if (file_end < page_size)
     return give_error("Error seeking index file");
+  my_off_t pos= file_end - page_size;
 
   for (;;)
   {
-    Node_page *page= alloc_and_read_page();
+    Node_page *page= alloc_and_read_page(pos);
     if (!page)
       return 1;
-    if (mysql_file_tell(index_file, MYF(0)) == page_size)
+    if (pos == 0)
       page->flag_ptr= &page->page[GTID_INDEX_FILE_HEADER_SIZE];
     else
       page->flag_ptr= &page->page[0];
@@ -1202,9 +1210,9 @@ Gtid_index_reader::read_root_node()
       return give_error("Corrupt or truncated index, no root node found");
     if (!(flags & PAGE_FLAG_IS_CONT))
       break;                           // Found start of root node
-    if (MY_FILEPOS_ERROR == mysql_file_seek(index_file, -(int32)(2*page_size),
-                                            MY_SEEK_CUR, MYF(0)))
+    if (pos < page_size)
       return give_error("Error seeking index file for multi-page root node");
+    pos-= page_size;
   }
 
   read_page= n->first_page;
@@ -1226,19 +1234,17 @@ Gtid_index_reader::read_node(uint32 page_ptr)
 int
 Gtid_index_reader::read_node_cold(uint32 page_ptr)
 {
-  if (MY_FILEPOS_ERROR == mysql_file_seek(index_file, (page_ptr-1)*page_size,
-                                          MY_SEEK_SET, MYF(0)))
-    return give_error("Error seeking index file");
-
+  my_off_t pos= (my_off_t)(page_ptr-1)*page_size;
   bool file_header= (page_ptr == 1);
   cold_node.reset();
   n= &cold_node;
   Node_page **next_ptr_ptr= &n->first_page;
   for (;;)
   {
-    Node_page *page= alloc_and_read_page();
+    Node_page *page= alloc_and_read_page(pos);
     if (!page)
       return 1;
+    pos+= page_size;
     page->flag_ptr= &page->page[file_header ? GTID_INDEX_FILE_HEADER_SIZE : 0];
     file_header= false;
     /* Insert the page at the end of the list. */
@@ -467,7 +467,7 @@ class Gtid_index_reader : public Gtid_index_base
   int get_gtid_list(rpl_gtid *out_gtid_list, uint32 count);
   virtual int read_file_header();
   int verify_checksum(Node_page *page);
-  Node_page *alloc_and_read_page();
+  Node_page *alloc_and_read_page(my_off_t pos);
   virtual int read_root_node();
   virtual int read_node(uint32 page_ptr);
   int read_node_cold(uint32 page_ptr);
@@ -483,6 +483,8 @@ class Gtid_index_reader : public Gtid_index_base
   Node_page *read_page;
   uchar *read_ptr;
   File index_file;
+  /* Size of the index file when the header was read. */
+  my_off_t file_end;
   uint32 current_offset;
   uint32 in_search_offset;
   bool file_open;
@@ -4853,6 +4853,7 @@ class Rows_log_event : public Log_event
   KEY      *m_key_info; /* Pointer to KEY info for m_key_nr */
   uint      m_key_nr;   /* Key number */
   uint      m_usable_key_parts; /* A number of key_parts suited to lookup */
+  ulonglong m_scan_rows_read;   /* Rows read since the table scan started */
   bool master_had_triggers;     /* set after tables opening */
 
   /*
@@ -4904,6 +4905,7 @@ class Rows_log_event : public Log_event
   uint find_key_parts(const KEY *key) const;
   bool use_pk_position() const;
   int find_row(rpl_group_info *);
+  void end_find_row();
   int write_row(rpl_group_info *, const bool);
   int update_sequence();
 
@@ -4623,7 +4623,7 @@ Rows_log_event::Rows_log_event(THD *thd_arg, TABLE *tbl_arg,
 #ifdef HAVE_REPLICATION
     , m_curr_row(NULL), m_curr_row_end(NULL),
     m_key(NULL), m_key_info(NULL), m_key_nr(0),
-    master_had_triggers(0)
+    m_scan_rows_read(0), master_had_triggers(0)
 #endif
 {
   /*
@@ -7491,7 +7491,7 @@ static int end_of_file_error(rpl_group_info *rgi)
   @note If the engine allows random access of the records, a combination of
   @c position() and @c rnd_pos() will be used. 
 
-  Note that one MUST call ha_index_or_rnd_end() after this function if
+  Note that one MUST call end_find_row() after this function if
   it returns 0 as we must leave the row position in the handler intact
   for any following update/delete command.
 */
@@ -7725,18 +7725,37 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
     /* We use this to test that the correct key is used in test cases. */
     DBUG_EXECUTE_IF("slave_crash_if_table_scan", abort(););
 
-    /* We don't have a key: search the table using rnd_next() */
-    if (unlikely((error= table->file->ha_rnd_init_with_error(1))))
+    /*
+      We don't have a key: search the table using rnd_next().
+
+      The scan is kept open between the rows of the event (see
+      end_find_row()) and the search continues from the row that was
+      found last. The rows of an event that was logged for a table scan
+      on the master come in scan order, so a bulk DELETE or UPDATE is
+      applied in about one pass over the table instead of one pass per
+      row. If the end of the table is reached, the scan wraps around
+      once and stops after the rows that preceded the starting point.
+    */
+    ulonglong wrap_limit= 0;
+    bool wrapped= false;
+
+    if (table->file->inited == handler::RND)
+      wrap_limit= m_scan_rows_read;
+    else
     {
-      DBUG_PRINT("info",("error initializing table scan"
-                         " (ha_rnd_init returns %d)",error));
-      goto end;
+      if (unlikely((error= table->file->ha_rnd_init_with_error(1))))
+      {
+        DBUG_PRINT("info",("error initializing table scan"
+                           " (ha_rnd_init returns %d)",error));
+        goto end;
+      }
+      m_scan_rows_read= 0;
     }
 
     is_table_scan= true;
 
     /* Continue until we find the right record or have made a full loop */
-    do
+    for (;;)
     {
       if (unlikely((error= table->file->ha_rnd_next(table->record[0]))))
         DBUG_PRINT("info", ("error: %s", HA_ERR(error)));
@@ -7744,13 +7763,31 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
 
       case 0:
         DBUG_DUMP("record found", table->record[0], table->s->reclength);
+        m_scan_rows_read++;
+        /*
+          Note: record_compare will take into accout all record fields
+          which might be incorrect in case a partial row was given in
+          the event
+        */
+        if (!record_compare(table, m_vers_from_plain))
+          goto end;
+        if (!wrapped || m_scan_rows_read < wrap_limit)
+          continue;
+        /* Every row of the table has been compared */
         break;
 
       case HA_ERR_END_OF_FILE:
-        error= end_of_file_error(rgi);
-        DBUG_PRINT("info", ("Record not found"));
-        table->file->ha_rnd_end();
-        goto end;
+        if (!wrapped && wrap_limit)
+        {
+          DBUG_PRINT("info", ("Restarting the table scan"));
+          wrapped= true;
+          table->file->ha_rnd_end();
+          if (unlikely((error= table->file->ha_rnd_init_with_error(1))))
+            goto end;
+          m_scan_rows_read= 0;
+          continue;
+        }
+        break;
 
       default:
         DBUG_PRINT("info", ("Failed to get next record"
@@ -7759,15 +7796,12 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
         table->file->ha_rnd_end();
         goto end;
       }
-    }
-    while (record_compare(table, m_vers_from_plain));
-    
-    /* 
-      Note: above record_compare will take into accout all record fields 
-      which might be incorrect in case a partial row was given in the event
-     */
 
-    DBUG_ASSERT(error == HA_ERR_END_OF_FILE || error == 0);
+      error= end_of_file_error(rgi);
+      DBUG_PRINT("info", ("Record not found"));
+      table->file->ha_rnd_end();
+      goto end;
+    }
   }
 
 end:
@@ -7777,6 +7811,24 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
   DBUG_RETURN(error);
 }
 
+
+/**
+  Finish the lookup of a row done by find_row() after the row has been
+  processed.
+
+  A table scan is left open so that find_row() can continue it for the
+  next row of the event; it is closed in do_after_row_operations().
+  Versioned tables are excluded, because applying a row to them may
+  insert history rows that the open scan would then visit.
+*/
+
+void Rows_log_event::end_find_row()
+{
+  handler *file= m_table->file;
+  if (file->inited != handler::RND || m_table->versioned())
+    file->ha_index_or_rnd_end();
+}
+
 #endif
 
 /*
@@ -7899,7 +7951,7 @@ int Delete_rows_log_event::do_exec_row(rpl_group_info *rgi)
     if (invoke_triggers && likely(!error) &&
         unlikely(process_triggers(TRG_EVENT_DELETE, TRG_ACTION_AFTER, FALSE)))
       error= HA_ERR_GENERIC; // in case if error is not set yet
-    m_table->file->ha_index_or_rnd_end();
+    end_find_row();
   }
   thd_proc_info(thd, tmp);
   return error;
@@ -8132,7 +8184,7 @@ Update_rows_log_event::do_exec_row(rpl_group_info *rgi)
 
 err:
   thd_proc_info(thd, tmp);
-  m_table->file->ha_index_or_rnd_end();
+  end_find_row();
   return error;
 }
 
@@ -953,7 +953,9 @@ MDL_context::MDL_context()
   m_owner(NULL),
   m_needs_thr_lock_abort(FALSE),
   m_waiting_for(NULL),
-  m_pins(NULL)
+  m_pins(NULL),
+  m_free_tickets(NULL),
+  m_free_tickets_count(0)
 {
   mysql_prlock_init(key_MDL_context_LOCK_waiting_for, &m_LOCK_waiting_for);
 }
@@ -977,6 +979,14 @@ void MDL_context::destroy()
   DBUG_ASSERT(m_tickets[MDL_TRANSACTION].is_empty());
   DBUG_ASSERT(m_tickets[MDL_EXPLICIT].is_empty());
 
+  while (m_free_tickets)
+  {
+    MDL_ticket *ticket= m_free_tickets;
+    m_free_tickets= ticket->next_in_context;
+    delete ticket;
+  }
+  m_free_tickets_count= 0;
+
   mysql_prlock_destroy(&m_LOCK_waiting_for);
   if (m_pins)
     lf_hash_put_pins(m_pins);
@@ -1050,12 +1060,22 @@ void MDL_request::init_by_key_with_source(const MDL_key *key_arg,
 }
 
 
+/**
+  Maximum number of released tickets an MDL_context keeps for reuse.
+  A statement rarely holds more locks than this, while the memory kept
+  per connection stays small.
+*/
+
+static const uint MDL_FREE_TICKETS_MAX= 16;
+
+
 /**
   Auxiliary functions needed for creation/destruction of MDL_ticket
   objects.
 
-  @todo This naive implementation should be replaced with one that saves
-        on memory allocation by reusing released objects.
+  Released tickets are kept in a small per-context list and reused by
+  the next lock request of the same context, which saves on memory
+  allocation for every table opened by every statement.
 */
 
 MDL_ticket *MDL_ticket::create(MDL_context *ctx_arg, enum_mdl_type type_arg
@@ -1064,6 +1084,18 @@ MDL_ticket *MDL_ticket::create(MDL_context *ctx_arg, enum_mdl_type type_arg
 #endif
                                )
 {
+  if (MDL_ticket *ticket= ctx_arg->m_free_tickets)
+  {
+    ctx_arg->m_free_tickets= ticket->next_in_context;
+    ctx_arg->m_free_tickets_count--;
+    ticket->~MDL_ticket();
+    return new (ticket)
+               MDL_ticket(ctx_arg, type_arg
+#ifndef DBUG_OFF
+                          , duration_arg
+#endif
+                          );
+  }
   return new (std::nothrow)
              MDL_ticket(ctx_arg, type_arg
 #ifndef DBUG_OFF
@@ -1078,6 +1110,15 @@ void MDL_ticket::destroy(MDL_ticket *ticket)
   mysql_mdl_destroy(ticket->m_psi);
   ticket->m_psi= NULL;
 
+  MDL_context *ctx= ticket->m_ctx;
+  if (ctx->m_free_tickets_count < MDL_FREE_TICKETS_MAX)
+  {
+    ticket->m_lock= NULL;
+    ticket->next_in_context= ctx->m_free_tickets;
+    ctx->m_free_tickets= ticket;
+    ctx->m_free_tickets_count++;
+    return;
+  }
   delete ticket;
 }
 
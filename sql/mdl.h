@@ -977,6 +977,7 @@ class MDL_context
   */
   MDL_wait m_wait;
 private:
+  friend class MDL_ticket;
   /**
     Lists of all MDL tickets acquired by this connection.
 
@@ -1062,6 +1063,13 @@ class MDL_context
   MDL_wait_for_subgraph *m_waiting_for;
   LF_PINS *m_pins;
   uint m_deadlock_overweight;
+  /**
+    Tickets released by this context, kept for reuse by MDL_ticket::create()
+    so that acquiring a lock doesn't need a memory allocation each time.
+    Only accessed by the thread owning the context.
+  */
+  MDL_ticket *m_free_tickets;
+  uint m_free_tickets_count;
 private:
   MDL_ticket *find_ticket(MDL_request *mdl_req,
                           enum_mdl_duration *duration);
@@ -1475,6 +1475,40 @@ bool Protocol_text::store_numeric_string_aux(const char *from, size_t length)
 }
 
 
+/**
+  Store an integer in text format.
+
+  The digits are written directly into the packet behind a one byte
+  length prefix (an integer is at most 20 characters long), which saves
+  the intermediate buffer and the net_store_data() call for every
+  integer column of every row. Protocols that override net_store_data(),
+  the embedded server, and result character sets that are not ASCII
+  compatible go through store_numeric_string_aux().
+*/
+
+bool Protocol_text::store_integer_aux(longlong from, bool unsigned_flag)
+{
+  int radix= unsigned_flag ? 10 : -10;
+#ifndef EMBEDDED_LIBRARY
+  CHARSET_INFO *tocs= thd->variables.character_set_results;
+  if (!(tocs && (tocs->state & MY_CS_NONASCII)) && type() == PROTOCOL_TEXT)
+  {
+    size_t packet_length= packet->length();
+    if (packet->reserve(22, PACKET_BUFFER_EXTRA_ALLOC))
+      return true;
+    char *length_pos= (char*) packet->ptr() + packet_length;
+    char *end= longlong10_to_str(from, length_pos + 1, radix);
+    *length_pos= (char) (end - length_pos - 1);
+    packet->length((uint32) (end - packet->ptr()));
+    return false;
+  }
+#endif
+  char buff[22];
+  size_t length= (size_t) (longlong10_to_str(from, buff, radix) - buff);
+  return store_numeric_string_aux(buff, length);
+}
+
+
 bool Protocol::store_warning(const char *from, size_t length)
 {
   BinaryStringBuffer<MYSQL_ERRMSG_SIZE> tmp;
@@ -1523,9 +1557,7 @@ bool Protocol_text::store_tiny(longlong from)
   DBUG_ASSERT(valid_handler(field_pos, PROTOCOL_SEND_TINY));
   field_pos++;
 #endif
-  char buff[22];
-  size_t length= (size_t) (int10_to_str((int) from, buff, -10) - buff);
-  return store_numeric_string_aux(buff, length);
+  return store_integer_aux(from, false);
 }
 
 
@@ -1535,9 +1567,7 @@ bool Protocol_text::store_short(longlong from)
   DBUG_ASSERT(valid_handler(field_pos, PROTOCOL_SEND_SHORT));
   field_pos++;
 #endif
-  char buff[22];
-  size_t length= (size_t) (int10_to_str((int) from, buff, -10) - buff);
-  return store_numeric_string_aux(buff, length);
+  return store_integer_aux(from, false);
 }
 
 
@@ -1547,10 +1577,7 @@ bool Protocol_text::store_long(longlong from)
   DBUG_ASSERT(valid_handler(field_pos, PROTOCOL_SEND_LONG));
   field_pos++;
 #endif
-  char buff[22];
-  size_t length= (size_t) (int10_to_str((long int)from, buff,
-                                        (from < 0) ? - 10 : 10) - buff);
-  return store_numeric_string_aux(buff, length);
+  return store_integer_aux(from, false);
 }
 
 
@@ -1560,11 +1587,7 @@ bool Protocol_text::store_longlong(longlong from, bool unsigned_flag)
   DBUG_ASSERT(valid_handler(field_pos, PROTOCOL_SEND_LONGLONG));
   field_pos++;
 #endif
-  char buff[22];
-  size_t length= (size_t) (longlong10_to_str(from, buff,
-                                             unsigned_flag ? 10 : -10) -
-                           buff);
-  return store_numeric_string_aux(buff, length);
+  return store_integer_aux(from, unsigned_flag);
 }
 
 
@@ -204,6 +204,7 @@ class Protocol_text :public Protocol
 {
   StringBuffer<FLOATING_POINT_BUFFER> buffer;
   bool store_numeric_string_aux(const char *from, size_t length);
+  bool store_integer_aux(longlong from, bool unsigned_flag);
 public:
   Protocol_text(THD *thd_arg, ulong prealloc= 0)
    :Protocol(thd_arg)
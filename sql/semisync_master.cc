@@ -586,7 +586,7 @@ void Repl_semi_sync_master::remove_slave()
 
 
 /*
-  Check report package
+  Check report package and merge the acknowledged position into 'ack'
 
   @retval 0   ok
   @retval 1   Error
@@ -595,7 +595,8 @@ void Repl_semi_sync_master::remove_slave()
 
 int Repl_semi_sync_master::report_reply_packet(uint32 server_id,
                                                const uchar *packet,
-                                               ulong packet_len)
+                                               ulong packet_len,
+                                               Semi_sync_ack *ack)
 {
   int result= 1;                                // Assume error
   char log_file_name[FN_REFLEN+1];
@@ -642,7 +643,7 @@ int Repl_semi_sync_master::report_reply_packet(uint32 server_id,
                           log_file_name, (ulong)log_file_pos, server_id));
 
   rpl_semi_sync_master_get_ack++;
-  report_reply_binlog(server_id, log_file_name, log_file_pos);
+  ack->merge(server_id, log_file_name, log_file_pos);
   DBUG_RETURN(0);
 
 l_end:
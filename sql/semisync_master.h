@@ -405,6 +405,37 @@ class Active_tranx
 
 };
 
+/**
+   The most advanced binlog position that the slaves have acknowledged
+   during one pass of the ack receiver over its sockets. Replies read in
+   the same pass are merged here, so that LOCK_binlog is taken once per
+   pass instead of once per reply.
+*/
+struct Semi_sync_ack
+{
+  uint32   server_id;
+  my_off_t log_file_pos;
+  char     log_file_name[FN_REFLEN+1];
+
+  Semi_sync_ack() : server_id(0), log_file_pos(0) { clear(); }
+  void clear() { log_file_name[0]= '\0'; }
+  bool empty() const { return !log_file_name[0]; }
+
+  /* Remember the position if it is ahead of the one already stored */
+  void merge(uint32 server_id_arg, const char *log_file_name_arg,
+             my_off_t log_file_pos_arg)
+  {
+    if (empty() ||
+        Active_tranx::compare(log_file_name_arg, log_file_pos_arg,
+                              log_file_name, log_file_pos) > 0)
+    {
+      server_id= server_id_arg;
+      strmake_buf(log_file_name, log_file_name_arg);
+      log_file_pos= log_file_pos_arg;
+    }
+  }
+};
+
 /**
    The extension class for the master of semi-synchronous replication
 */
@@ -560,9 +591,12 @@ class Repl_semi_sync_master
   /* Remove a semi-sync replication slave */
   void remove_slave();
 
-  /* It parses a reply packet and call report_reply_binlog to handle it. */
+  /*
+    It parses a reply packet and merges the acknowledged position into
+    'ack'. The caller reports the merged position with report_reply_binlog().
+  */
   int report_reply_packet(uint32 server_id, const uchar *packet,
-                        ulong packet_len);
+                          ulong packet_len, Semi_sync_ack *ack);
 
   /* In semi-sync replication, reports up to which binlog position we have
    * received replies from the slave indicating that it already get the events.
@@ -233,6 +233,7 @@ void Ack_receiver::run()
   THD *thd= new THD(next_thread_id());
   NET net;
   unsigned char net_buff[REPLY_MESSAGE_MAX_LENGTH];
+  Semi_sync_ack ack;
   DBUG_ENTER("Ack_receiver::run");
 
   my_thread_init();
@@ -321,6 +322,7 @@ void Ack_receiver::run()
     listener.clear_signal();
     mysql_mutex_lock(&m_mutex);
     set_stage_info(stage_reading_semi_sync_ack);
+    ack.clear();
     Slave_ilist_iterator it(m_slaves);
     while ((slave= it++))
     {
@@ -330,8 +332,6 @@ void Ack_receiver::run()
       {
         ulong len;
 
-        /* Semi-sync packets will always be sent with pkt_nr == 1 */
-        net_clear(&net, 0);
         net.vio= &slave->vio;
         /*
           Set compress flag. This is needed to support
@@ -350,34 +350,60 @@ void Ack_receiver::run()
           continue;
         }
 
-        len= my_net_read(&net);
-        if (likely(len != packet_error))
+        /*
+          Read all replies that the slave has already sent. Only the
+          last one matters, as the positions only move forward. The
+          connection does not buffer reads, so check the socket itself
+          for more data, without waiting.
+        */
+        do
         {
-          int res;
-          res= repl_semisync_master.report_reply_packet(slave->server_id(),
-                                                        net.read_pos, len);
-          if (unlikely(res < 0))
+          /* Semi-sync packets will always be sent with pkt_nr == 1 */
+          net_clear(&net, 0);
+          len= my_net_read(&net);
+          if (likely(len != packet_error))
           {
-            /*
-              Slave has sent COM_QUIT or other failure.
-              Delete it from listener
-            */
-            it.remove();
-            m_slaves_changed= true;
+            int res;
+            res= repl_semisync_master.report_reply_packet(slave->server_id(),
+                                                          net.read_pos, len,
+                                                          &ack);
+            if (unlikely(res < 0))
+            {
+              /*
+                Slave has sent COM_QUIT or other failure.
+                Delete it from listener
+              */
+              it.remove();
+              m_slaves_changed= true;
+              break;
+            }
           }
-        }
-        else if (net.last_errno == ER_NET_READ_ERROR)
-        {
-          if (net.last_errno > 0 && global_system_variables.log_warnings > 2)
-            sql_print_warning("Semisync ack receiver got error %d \"%s\" "
-                              "from slave server-id %d",
-                              net.last_errno, ER_DEFAULT(net.last_errno),
-                              slave->server_id());
-          it.remove();
-          m_slaves_changed= true;
-        }
+          else
+          {
+            if (net.last_errno == ER_NET_READ_ERROR)
+            {
+              if (net.last_errno > 0 && global_system_variables.log_warnings > 2)
+                sql_print_warning("Semisync ack receiver got error %d \"%s\" "
+                                  "from slave server-id %d",
+                                  net.last_errno, ER_DEFAULT(net.last_errno),
+                                  slave->server_id());
+              it.remove();
+              m_slaves_changed= true;
+            }
+            break;
+          }
+        } while (vio_io_wait(&slave->vio, VIO_IO_EVENT_READ, 0) > 0);
       }
     }
+
+    /*
+      Report the most advanced position acknowledged by any slave in this
+      pass, which releases every transaction waiting up to that point.
+    */
+    if (!ack.empty())
+      repl_semisync_master.report_reply_binlog(ack.server_id,
+                                               ack.log_file_name,
+                                               ack.log_file_pos);
     mysql_mutex_unlock(&m_mutex);
   }
 
@@ -968,11 +968,23 @@ bool mysql_insert(THD *thd, TABLE_LIST *table_list,
       Engines can't handle a bulk insert in parallel with a read form the
       same table in the same connection.
     */
+    ha_rows bulk_rows= values_list.elements;
+    /*
+      A bulk execution of a prepared statement (COM_STMT_BULK_EXECUTE)
+      inserts values_list once for every parameter set, so even a single
+      row VALUES list is a multi-row insert. The number of parameter sets
+      is not known in advance, 0 tells the engine so. This is not done if
+      the client asked for per-row results, which must not be deferred to
+      end_bulk_insert().
+    */
+    if (bulk_parameters_iterations(thd) && !thd->need_report_unit_results())
+      bulk_rows= 0;
     if (thd->locked_tables_mode <= LTM_LOCK_TABLES &&
-        !table->s->long_unique_table && values_list.elements > 1)
+        !table->s->long_unique_table &&
+        (values_list.elements > 1 || bulk_rows == 0))
     {
       using_bulk_insert= 1;
-      table->file->ha_start_bulk_insert(values_list.elements);
+      table->file->ha_start_bulk_insert(bulk_rows);
     }
     else
       table->file->ha_reset_copy_info();
@@ -94,6 +94,12 @@ thread_group_t *all_groups;
 static uint group_count;
 static Atomic_counter<uint32_t> shutdown_group_count;
 
+/**
+  Set when the pool starts to shut down. Stops workers from touching
+  other groups (see steal_connection() and wake_thread_to_steal()).
+*/
+static std::atomic<bool> pool_shutdown;
+
 /**
  Used for printing "pool blocked" message, see
  print_pool_blocked_message();
@@ -117,6 +123,7 @@ static pool_timer_t pool_timer;
 static void queue_put(thread_group_t *thread_group, TP_connection_generic *connection);
 static void queue_put(thread_group_t *thread_group, native_event *ev, int cnt);
 static int  wake_thread(thread_group_t *thread_group,bool due_to_stall);
+static void wake_thread_to_steal(thread_group_t *thread_group);
 static int  wake_or_create_thread(thread_group_t *thread_group, bool due_to_stall=false);
 static int  create_worker(thread_group_t *thread_group, bool due_to_stall);
 static void *worker_main(void *param);
@@ -826,6 +833,15 @@ static TP_connection_generic * listener(worker_thread_t *current_thread,
         }
       }
     }
+    else
+    {
+      /*
+        The queue waits for the active workers. Rather than waiting for
+        the timer to detect a stall, let a worker of an idle group take
+        the work.
+      */
+      wake_thread_to_steal(thread_group);
+    }
     mysql_mutex_unlock(&thread_group->mutex);
   }
 
@@ -997,7 +1013,6 @@ int thread_group_init(thread_group_t *thread_group, pthread_attr_t* thread_attr)
 
 void thread_group_destroy(thread_group_t *thread_group)
 {
-  mysql_mutex_destroy(&thread_group->mutex);
   if (thread_group->pollfd != INVALID_HANDLE_VALUE)
   {
     io_poll_close(thread_group->pollfd);
@@ -1014,8 +1029,14 @@ void thread_group_destroy(thread_group_t *thread_group)
   }
 #endif
 
+  /*
+    Group mutexes are destroyed only when all groups are done, because
+    workers of other groups may still lock them, see steal_connection().
+  */
   if (!--shutdown_group_count)
   {
+    for (uint i= 0; i < threadpool_max_size; i++)
+      mysql_mutex_destroy(&all_groups[i].mutex);
     my_free(all_groups);
     all_groups= 0;
   }
@@ -1085,6 +1106,7 @@ static void thread_group_close(thread_group_t *thread_group)
   mysql_mutex_lock(&thread_group->mutex);
   if (thread_group->thread_count == 0)
   {
+    thread_group->shutdown= true;
     mysql_mutex_unlock(&thread_group->mutex);
     thread_group_destroy(thread_group);
     DBUG_VOID_RETURN;
@@ -1140,6 +1162,140 @@ static bool too_many_threads(thread_group_t *thread_group)
 }
 
 
+/**
+  Check whether a group has work that is waiting for its busy workers.
+
+  This is the case if there are queued connections while at least one
+  worker is active. The group does not wake another worker then (see
+  listener()), so the queue waits until the active workers finish, or
+  until the timer detects a stall.
+*/
+
+static bool has_work_to_steal(thread_group_t *thread_group)
+{
+  return !thread_group->shutdown && thread_group->active_thread_count > 0 &&
+    !is_queue_empty(thread_group);
+}
+
+
+/**
+  Take a queued connection from another group, which has work waiting
+  for its busy workers (see has_work_to_steal()).
+
+  Without stealing, such work would wait even if other groups are idle,
+  because connections are assigned to groups by thread_id.
+
+  Only a worker that is the single active thread of its group, and whose
+  own queue is empty, steals (see get_event()). Thus stealing adds at most
+  one active thread per idle group, and does not raise concurrency of
+  groups that are busy themselves.
+
+  The stolen connection migrates to the current group, like change_group()
+  does, so that wait_begin()/wait_end() and start_io() work with the group
+  of the thread that executes it.
+
+  Like change_group(), this never holds two group mutexes at the same
+  time. The mutex of the current group is released while the other group
+  is locked, thus the caller must recheck the state of its group if
+  *relocked is set and no connection was returned.
+
+  @param thread_group - current thread group, its mutex must be locked
+  @param relocked - set to true, if the group mutex was released and
+                    locked again
+
+  @return connection taken from another group, or NULL
+*/
+
+static TP_connection_generic *steal_connection(thread_group_t *thread_group,
+                                               bool *relocked)
+{
+  uint n_groups= group_count;
+  *relocked= false;
+  if (n_groups < 2 || pool_shutdown)
+    return NULL;
+
+  mysql_mutex_assert_owner(&thread_group->mutex);
+  uint group_id= (uint) (thread_group - all_groups);
+  for (uint i= 1; i < n_groups; i++)
+  {
+    thread_group_t *victim= &all_groups[(group_id + i) % n_groups];
+
+    /* Unlocked check first, to avoid mutex traffic on idle groups. */
+    if (!has_work_to_steal(victim))
+      continue;
+
+    mysql_mutex_unlock(&thread_group->mutex);
+    *relocked= true;
+
+    mysql_mutex_lock(&victim->mutex);
+    TP_connection_generic *c= NULL;
+    if (has_work_to_steal(victim) && (c= queue_get(victim)))
+    {
+      if (c->bound_to_poll_descriptor)
+      {
+        io_poll_disassociate_fd(victim->pollfd, c->fd);
+        c->bound_to_poll_descriptor= false;
+      }
+      victim->connection_count--;
+    }
+    mysql_mutex_unlock(&victim->mutex);
+
+    mysql_mutex_lock(&thread_group->mutex);
+    if (c)
+    {
+      c->thread_group= thread_group;
+      thread_group->connection_count++;
+      TP_INCREMENT_GROUP_COUNTER(thread_group, steals);
+    }
+    return c;
+  }
+  return NULL;
+}
+
+
+/* Group without active threads and queued work, that has a worker to wake. */
+static bool is_idle_group(thread_group_t *thread_group)
+{
+  return !thread_group->shutdown && thread_group->active_thread_count == 0 &&
+    is_queue_empty(thread_group) && !thread_group->waiting_threads.is_empty();
+}
+
+
+/**
+  Wake a worker in an idle group, i.e a group without active threads and
+  queued work, so that it can steal work queued in this group (see
+  steal_connection()). Groups that are busy themselves are left alone.
+
+  Called with the mutex of the current group locked, so other groups'
+  mutexes are only try-locked.
+*/
+
+static void wake_thread_to_steal(thread_group_t *thread_group)
+{
+  uint n_groups= group_count;
+  if (n_groups < 2 || pool_shutdown)
+    return;
+
+  mysql_mutex_assert_owner(&thread_group->mutex);
+  uint group_id= (uint) (thread_group - all_groups);
+  for (uint i= 1; i < n_groups; i++)
+  {
+    thread_group_t *other= &all_groups[(group_id + i) % n_groups];
+
+    /* Unlocked check first, to avoid mutex traffic on busy groups. */
+    if (!is_idle_group(other))
+      continue;
+
+    if (mysql_mutex_trylock(&other->mutex))
+      continue;
+    bool woken= is_idle_group(other) && !wake_thread(other, false);
+    mysql_mutex_unlock(&other->mutex);
+    if (woken)
+      return;
+  }
+}
+
+
 /**
   Retrieve a connection with pending event.
 
@@ -1220,6 +1376,19 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /*
+      Help other groups, if they can't keep up with their queues, but only
+      if this group is otherwise idle.
+    */
+    if (thread_group->active_thread_count == 1 && is_queue_empty(thread_group))
+    {
+      bool relocked;
+      connection= steal_connection(thread_group, &relocked);
+      if (connection)
+        break;
+      if (relocked)
+        continue;
+    }
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
@@ -1596,6 +1765,7 @@ int TP_pool_generic::init()
   PSI_register(thread);
   scheduler_init();
   threadpool_started= true;
+  pool_shutdown= false;
   for (uint i= 0; i < threadpool_max_size; i++)
   {
     thread_group_init(&all_groups[i], get_connection_attrib());
@@ -1620,6 +1790,7 @@ TP_pool_generic::~TP_pool_generic()
     DBUG_VOID_RETURN;
 
   stop_timer(&pool_timer);
+  pool_shutdown= true;
   shutdown_group_count= threadpool_max_size;
   for (uint i= 0; i < threadpool_max_size; i++)
   {
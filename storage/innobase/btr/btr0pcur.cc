@@ -29,6 +29,7 @@ Created 2/23/1996 Heikki Tuuri
 #include "rem0cmp.h"
 #include "trx0trx.h"
 #include "ibuf0ibuf.h"
+#include "mariadb_stats.h"
 
 /**************************************************************//**
 Resets a persistent cursor object, freeing ::old_rec_buf if it is
@@ -47,6 +48,7 @@ btr_pcur_reset(
 
 	cursor->latch_mode = BTR_NO_LATCHES;
 	cursor->pos_state = BTR_PCUR_NOT_POSITIONED;
+	cursor->end_tuple = NULL;
 }
 
 /**************************************************************//**
@@ -476,6 +478,64 @@ btr_pcur_t::restore_position(btr_latch_mode restore_latch_mode, mtr_t *mtr)
 	return ret_val;
 }
 
+/** Prefetch the right sibling of a leaf page that a forward range scan
+has just moved to, so that the read of the following leaf overlaps with the
+processing of this one. Linear read-ahead only kicks in at extent
+boundaries after most of an extent has been accessed, which does not help
+scans of indexes whose leaf pages are scattered across the tablespace.
+
+Only scans that know their end key prefetch, and only if the last record of
+the page is still before it, that is, the scan will continue on the right
+sibling unless it is stopped early.
+@param cursor	persistent cursor
+@param block	leaf page that the cursor moved to */
+static void btr_pcur_prefetch_next_page(const btr_pcur_t &cursor,
+                                        const buf_block_t *block)
+{
+  const dtuple_t *end= cursor.end_tuple;
+  const dict_index_t *index= cursor.index();
+  if (!end || !srv_read_ahead_threshold || index->table->is_temporary())
+    return;
+
+  const page_t *page= block->page.frame;
+  const uint32_t next=
+    mach_read_from_4(my_assume_aligned<4>(page + FIL_PAGE_NEXT));
+  if (next == FIL_NULL)
+    return;
+
+  const rec_t *rec= page_rec_get_prev_const(page_get_supremum_rec(page));
+  if (!rec || !page_rec_is_user_rec(rec))
+    return;
+
+  mem_heap_t *heap= nullptr;
+  rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+  rec_offs_init(offsets_);
+  const rec_offs *offsets= rec_get_offsets(rec, index, offsets_,
+                                           index->n_core_fields,
+                                           dtuple_get_n_fields_cmp(end),
+                                           &heap);
+  const bool past_end= cmp_dtuple_rec(end, rec, index, offsets) <= 0;
+  if (UNIV_LIKELY_NULL(heap))
+    mem_heap_free(heap);
+  if (past_end)
+    return;
+
+  const page_id_t page_id{index->table->space_id, next};
+  buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(page_id.fold());
+  if (buf_pool.page_hash_contains(page_id, chain))
+    return;
+
+  fil_space_t *space= index->table->space;
+  if (!space || !space->acquire())
+    return;
+  buf_read_page_background(space, page_id, block->zip_size());
+
+  mariadb_increment_pages_prefetched(1);
+  mysql_mutex_lock(&buf_pool.mutex);
+  buf_pool.stat.n_ra_pages_read++;
+  mysql_mutex_unlock(&buf_pool.mutex);
+}
+
 /*********************************************************//**
 Moves the persistent cursor to the first record on the next page. Releases the
 latch on the current page, and bufferunfixes it. Note that there must not be
@@ -536,6 +596,7 @@ btr_pcur_move_to_next_page(
 	if (first_access) {
 		buf_read_ahead_linear(next_block->page.id(),
 				      next_block->zip_size());
+		btr_pcur_prefetch_next_page(*cursor, next_block);
 	}
 	return DB_SUCCESS;
 }
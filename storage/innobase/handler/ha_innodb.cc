@@ -8969,6 +8969,23 @@ ha_innobase::index_read(
 		dtuple_set_n_fields(m_prebuilt->search_tuple, 0);
 	}
 
+	/* Convert the end key of a range scan, so that a forward scan
+	can prefetch leaf pages that are still in the range. */
+	if (end_range && end_range->length && !index->is_spatial()) {
+		dict_index_copy_types(
+			m_prebuilt->end_tuple, index,
+			dict_index_get_n_unique_in_tree(index));
+		row_sel_convert_mysql_key_to_innobase(
+			m_prebuilt->end_tuple,
+			m_prebuilt->srch_key_val3,
+			m_prebuilt->srch_key_val_len,
+			index,
+			end_range->key,
+			end_range->length);
+	} else {
+		dtuple_set_n_fields(m_prebuilt->end_tuple, 0);
+	}
+
 	page_cur_mode_t	mode;
 
 	if (convert_search_mode_to_innobase<true>(find_flag, mode,
@@ -346,6 +346,9 @@ struct btr_pcur_t
   byte *old_rec_buf= nullptr;
   /** old_rec_buf size if old_rec_buf is not NULL */
   ulint buf_size= 0;
+  /** end key of a forward range scan, or nullptr if it is not known;
+  see btr_pcur_move_to_next_page() */
+  const dtuple_t *end_tuple= nullptr;
 
   /** Return the index of this persistent cursor */
   dict_index_t *index() const { return(btr_cur.index()); }
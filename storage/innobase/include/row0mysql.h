@@ -550,6 +550,9 @@ struct row_prebuilt_t {
 	que_fork_t*	sel_graph;	/*!< dummy query graph used in
 					selects */
 	dtuple_t*	search_tuple;	/*!< prebuilt dtuple used in selects */
+	dtuple_t*	end_tuple;	/*!< end key of the range scan in
+					InnoDB format, or n_fields == 0 if
+					not known; see btr_pcur_t::end_tuple */
 	byte		row_id[DATA_ROW_ID_LEN];
 					/*!< if the clustered index was
 					generated, the row id of the
@@ -682,6 +685,9 @@ struct row_prebuilt_t {
 	byte*		srch_key_val2;  /*!< buffer used in converting
 					search key values from MySQL format
 					to InnoDB format.*/
+	byte*		srch_key_val3;  /*!< buffer used in converting
+					the end key of a range scan from
+					MySQL format to InnoDB format */
 	uint		srch_key_val_len; /*!< Size of search key */
 	/** The MySQL table object */
 	TABLE*		m_mysql_table;
@@ -4966,6 +4966,32 @@ row_merge_build_indexes(
 		}
 	}
 
+	if (online && old_table == new_table && n_indexes > 1) {
+		/* While the later indexes were being sorted and
+		inserted, concurrent DML kept appending to the online
+		log of the indexes that had already been built. Apply
+		that backlog now, while DML is still permitted, so that
+		commit_inplace_alter_table() has less to apply while
+		holding the exclusive MDL. The stage is passed on, so
+		that the progress of this pass is reported like that of
+		the other log apply passes. */
+		for (i = 0; i + 1 < n_indexes; i++) {
+			dict_index_t*	index = indexes[i];
+
+			if ((index->type & (DICT_FTS | DICT_SPATIAL))
+			    || index->is_corrupted()) {
+				continue;
+			}
+
+			error = row_log_apply(trx, index, table, stage);
+
+			if (error != DB_SUCCESS) {
+				trx->error_key_num = key_numbers[i];
+				goto func_exit;
+			}
+		}
+	}
+
 func_exit:
 
 	DBUG_EXECUTE_IF(
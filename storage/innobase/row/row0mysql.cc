@@ -786,6 +786,7 @@ row_create_prebuilt(
 	sizeof(*prebuilt) \
 	/* allocd in this function */ \
 	+ DTUPLE_EST_ALLOC(search_tuple_n_fields) \
+	+ DTUPLE_EST_ALLOC(search_tuple_n_fields) \
 	+ DTUPLE_EST_ALLOC(ref_len) \
 	/* allocd in row_prebuild_sel_graph() */ \
 	+ sizeof(sel_node_t) \
@@ -818,7 +819,8 @@ row_create_prebuilt(
 	flipped. All other field types are stored/compared the same
 	in MySQL and InnoDB, so we must create a buffer containing
 	the INT key parts in InnoDB format.We need two such buffers
-	since both start and end keys are used in records_in_range(). */
+	since both start and end keys are used in records_in_range(),
+	and a third one for the end key of a range scan. */
 
 	for (temp_index = dict_table_get_first_index(table); temp_index;
 	     temp_index = dict_table_get_next_index(temp_index)) {
@@ -848,7 +850,7 @@ row_create_prebuilt(
 	/* We allocate enough space for the objects that are likely to
 	be created later in order to minimize the number of malloc()
 	calls */
-	heap = mem_heap_create(PREBUILT_HEAP_INITIAL_SIZE + 2 * srch_key_len);
+	heap = mem_heap_create(PREBUILT_HEAP_INITIAL_SIZE + 3 * srch_key_len);
 
 	prebuilt = static_cast<row_prebuilt_t*>(
 		mem_heap_zalloc(heap, sizeof(*prebuilt)));
@@ -865,12 +867,15 @@ row_create_prebuilt(
 	if (prebuilt->srch_key_val_len) {
 		prebuilt->srch_key_val1 = static_cast<byte*>(
 			mem_heap_alloc(prebuilt->heap,
-				       2 * prebuilt->srch_key_val_len));
+				       3 * prebuilt->srch_key_val_len));
 		prebuilt->srch_key_val2 = prebuilt->srch_key_val1 +
 						prebuilt->srch_key_val_len;
+		prebuilt->srch_key_val3 = prebuilt->srch_key_val2 +
+						prebuilt->srch_key_val_len;
 	} else {
 		prebuilt->srch_key_val1 = NULL;
 		prebuilt->srch_key_val2 = NULL;
+		prebuilt->srch_key_val3 = NULL;
 	}
 
 	prebuilt->pcur = static_cast<btr_pcur_t*>(
@@ -886,6 +891,8 @@ row_create_prebuilt(
 	prebuilt->stored_select_lock_type = LOCK_NONE_UNSET;
 
 	prebuilt->search_tuple = dtuple_create(heap, search_tuple_n_fields);
+	prebuilt->end_tuple = dtuple_create(heap, search_tuple_n_fields);
+	dtuple_set_n_fields(prebuilt->end_tuple, 0);
 
 	ref = dtuple_create(heap, ref_len);
 
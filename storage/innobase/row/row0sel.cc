@@ -4685,6 +4685,12 @@ row_search_mvcc(
 		    || mode >= PAGE_CUR_CONTAIN) {
 			moves_up = true;
 		}
+
+		/* Let a forward range scan prefetch leaf pages up to
+		its end key, see btr_pcur_move_to_next_page(). */
+		pcur->end_tuple = moves_up && !index->is_spatial()
+			&& dtuple_get_n_fields(prebuilt->end_tuple)
+			? prebuilt->end_tuple : nullptr;
 	} else if (direction == ROW_SEL_NEXT) {
 		moves_up = true;
 	}
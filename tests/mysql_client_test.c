@@ -20912,6 +20912,123 @@ static void test_bulk_replace()
 }
 
 
+/*
+  Check that the indexes of t1 are consistent with its data, after a bulk
+  insert that may have disabled and rebuilt them.
+*/
+
+static void check_bulk_insert_indexes(int expected_rows)
+{
+  int rc;
+  MYSQL_RES *result;
+  MYSQL_ROW  row, last_row= NULL;
+
+  rc= mysql_query(mysql, "CHECK TABLE t1");
+  myquery(rc);
+  result= mysql_store_result(mysql);
+  mytest(result);
+  while ((row= mysql_fetch_row(result)))
+    last_row= row;
+  DIE_UNLESS(last_row && strcmp(last_row[3], "OK") == 0);
+  mysql_free_result(result);
+
+  rc= mysql_query(mysql, "SELECT (SELECT COUNT(*) FROM t1 FORCE INDEX(k)"
+                         "        WHERE k > 0),"
+                         "       (SELECT COUNT(*) FROM t1 IGNORE INDEX(k))");
+  myquery(rc);
+  result= mysql_store_result(mysql);
+  mytest(result);
+  row= mysql_fetch_row(result);
+  DIE_UNLESS(row);
+  DIE_IF(atoi(row[0]) != atoi(row[1]));
+  if (expected_rows >= 0)
+    DIE_IF(atoi(row[1]) != expected_rows);
+  mysql_free_result(result);
+}
+
+
+/*
+  Bulk execution of a single row INSERT starts a bulk insert in the
+  engine, which for an empty Aria table disables the non-unique indexes
+  and rebuilds them at the end of the statement.
+*/
+
+static void test_bulk_insert_ignore_aria()
+{
+  int rc;
+  MYSQL_STMT *stmt;
+  MYSQL_BIND bind[2];
+  MYSQL_ROW  row;
+  MYSQL_RES *result;
+  int        i,
+             id[]= {1, 2, 2, 3},
+             k[]= {10, 20, 30, 40},
+             count= sizeof(id)/sizeof(id[0]);
+  int        expected_k[]= {10, 20, 40};
+
+  myheader("test_bulk_insert_ignore_aria");
+  rc= mysql_query(mysql, "DROP TABLE IF EXISTS t1");
+  myquery(rc);
+  rc= mysql_query(mysql, "CREATE TABLE t1 (id int not null primary key, "
+                         "k int, key(k)) ENGINE=Aria");
+  myquery(rc);
+
+  memset(bind, 0, sizeof(bind));
+  bind[0].buffer_type = MYSQL_TYPE_LONG;
+  bind[0].buffer = (void *)id;
+  bind[0].buffer_length = 0;
+  bind[1].buffer_type = MYSQL_TYPE_LONG;
+  bind[1].buffer = (void *)k;
+  bind[1].buffer_length = 0;
+
+  /* IGNORE skips the duplicate and inserts the other rows */
+  stmt= mysql_stmt_init(mysql);
+  rc= mysql_stmt_prepare(stmt, "INSERT IGNORE INTO t1 VALUES (?, ?)", -1);
+  check_execute(stmt, rc);
+  mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, (void*)&count);
+  rc= mysql_stmt_bind_param(stmt, bind);
+  check_execute(stmt, rc);
+  rc= mysql_stmt_execute(stmt);
+  check_execute(stmt, rc);
+  DIE_IF(mysql_stmt_affected_rows(stmt) != 3);
+  mysql_stmt_close(stmt);
+
+  rc= mysql_query(mysql, "SELECT id, k FROM t1 FORCE INDEX(k) "
+                         "WHERE k > 0 ORDER BY k");
+  myquery(rc);
+  result= mysql_store_result(mysql);
+  mytest(result);
+  i= 0;
+  while ((row= mysql_fetch_row(result)))
+  {
+    DIE_IF(i >= 3);
+    DIE_IF(atoi(row[0]) != i + 1);
+    DIE_IF(atoi(row[1]) != expected_k[i]);
+    i++;
+  }
+  DIE_IF(i != 3);
+  mysql_free_result(result);
+  check_bulk_insert_indexes(3);
+
+  /* Without IGNORE the duplicate fails the statement */
+  rc= mysql_query(mysql, "TRUNCATE TABLE t1");
+  myquery(rc);
+  stmt= mysql_stmt_init(mysql);
+  rc= mysql_stmt_prepare(stmt, "INSERT INTO t1 VALUES (?, ?)", -1);
+  check_execute(stmt, rc);
+  mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, (void*)&count);
+  rc= mysql_stmt_bind_param(stmt, bind);
+  check_execute(stmt, rc);
+  rc= mysql_stmt_execute(stmt);
+  check_execute_r(stmt, rc);
+  DIE_UNLESS(mysql_stmt_errno(stmt) == ER_DUP_ENTRY);
+  mysql_stmt_close(stmt);
+  check_bulk_insert_indexes(-1);
+
+  rc= mysql_query(mysql, "DROP TABLE t1");
+  myquery(rc);
+}
+
 static void test_bulk_insert_returning()
 {
   int rc;
@@ -22613,6 +22730,7 @@ static struct my_tests_st my_tests[]= {
   { "test_bulk_autoinc", test_bulk_autoinc},
   { "test_bulk_delete", test_bulk_delete },
   { "test_bulk_replace", test_bulk_replace },
+  { "test_bulk_insert_ignore_aria", test_bulk_insert_ignore_aria },
   { "test_bulk_insert_returning", test_bulk_insert_returning },
   { "test_bulk_delete_returning", test_bulk_delete_returning },
 #endif